@@ -13,6 +13,15 @@
 #include <sstream>
 #include <cctype>
 #include <ctime>
+#include <functional>
+#include <set>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <tuple>
 
 
 
@@ -113,14 +122,403 @@ public:
            << std::setw(14) << value();
         return ss.str();
     }
+
+    // --- DESCRIPTORI DE CAMP (folositi de namespace query) ---
+    struct Id    { static constexpr const char* name = "id";       static int32_t get(const Material& m) { return m.id; } };
+    struct Name  { static constexpr const char* name = "name";     static const std::string& get(const Material& m) { return m.denumire; } };
+    struct Qty   { static constexpr const char* name = "quantity"; static int32_t get(const Material& m) { return m.cantitate; } };
+    struct Price { static constexpr const char* name = "price";    static double get(const Material& m) { return m.pret; } };
+    struct Value { static constexpr const char* name = "value";    static double get(const Material& m) { return m.value(); } };
+};
+
+// ===================== QUERY =====================
+// Sortare / filtrare / agregare generica peste descriptorii de camp ai lui
+// Material. Campul si directia sunt parametri de template, deci
+// comparatorii si predicatele se rezolva la compilare si se inlinieaza.
+namespace query {
+
+enum class Order { Asc, Desc };
+
+template <typename F>
+using FieldType = std::decay_t<decltype(F::get(std::declval<const Material&>()))>;
+
+// Acumulator pentru sume: intregii in int64_t (fara overflow pe int32_t),
+// restul in double
+template <typename F>
+using SumType = std::conditional_t<std::is_integral_v<FieldType<F>>, int64_t, double>;
+
+// Cheie de sortare: un camp + directia
+template <typename F, Order O = Order::Asc>
+struct By {
+    bool operator()(const Material& a, const Material& b) const {
+        if constexpr (O == Order::Asc)
+            return F::get(a) < F::get(b);
+        else
+            return F::get(b) < F::get(a);
+    }
+
+    static std::string describe() {
+        return std::string(F::name) + (O == Order::Asc ? " ASC" : " DESC");
+    }
+};
+
+// Cheie compusa: compara lexicografic dupa Keys, in ordine
+template <typename... Keys>
+struct Compare {
+    static_assert(sizeof...(Keys) > 0, "Compare necesita cel putin o cheie");
+
+    bool operator()(const Material& a, const Material& b) const {
+        bool less = false;
+        (void)((Keys{}(a, b) ? (less = true) : Keys{}(b, a)) || ...);
+        return less;
+    }
+
+    static std::string describe() {
+        std::string r;
+        ((r += (r.empty() ? "" : ", ") + Keys::describe()), ...);
+        return r;
+    }
+};
+
+// --- OPERATORI PENTRU PREDICATE ---
+struct Eq        { static constexpr const char* symbol = "==";
+                   template <typename A, typename B> bool operator()(const A& a, const B& b) const { return a == b; } };
+struct NotEq     { static constexpr const char* symbol = "!=";
+                   template <typename A, typename B> bool operator()(const A& a, const B& b) const { return a != b; } };
+struct Less      { static constexpr const char* symbol = "<";
+                   template <typename A, typename B> bool operator()(const A& a, const B& b) const { return a < b; } };
+struct LessEq    { static constexpr const char* symbol = "<=";
+                   template <typename A, typename B> bool operator()(const A& a, const B& b) const { return a <= b; } };
+struct Greater   { static constexpr const char* symbol = ">";
+                   template <typename A, typename B> bool operator()(const A& a, const B& b) const { return a > b; } };
+struct GreaterEq { static constexpr const char* symbol = ">=";
+                   template <typename A, typename B> bool operator()(const A& a, const B& b) const { return a >= b; } };
+
+// Predicat: camp <op> valoare
+template <typename F, typename Op>
+struct Where {
+    FieldType<F> value;
+
+    bool operator()(const Material& m) const { return Op{}(F::get(m), value); }
+
+    std::string describe() const {
+        std::ostringstream ss;
+        ss << F::name << " " << Op::symbol << " " << value;
+        return ss.str();
+    }
+};
+
+template <typename F, typename Op>
+Where<F, Op> where(FieldType<F> v) { return {std::move(v)}; }
+
+// Descrierea pentru log; lambda-urile si predicatele proprii fara
+// describe() apar ca "custom"
+template <typename P, typename = void>
+struct HasDescribe : std::false_type {};
+
+template <typename P>
+struct HasDescribe<P, std::void_t<decltype(std::declval<const P&>().describe())>>
+    : std::true_type {};
+
+template <typename P>
+std::string describe(const P& p) {
+    if constexpr (HasDescribe<P>::value)
+        return p.describe();
+    else
+        return "custom";
+}
+
+template <typename... Ps>
+std::string describeAll(const std::tuple<Ps...>& preds, const char* sep) {
+    return std::apply([sep](const auto&... p) {
+        std::string r;
+        ((r += (r.empty() ? "" : sep) + query::describe(p)), ...);
+        return "(" + r + ")";
+    }, preds);
+}
+
+// --- COMBINATORI ---
+// ex: allOf(where<Material::Qty, LessEq>(4), where<Material::Price, Greater>(100.0))
+template <typename... Ps>
+struct AllOf {
+    std::tuple<Ps...> preds;
+
+    bool operator()(const Material& m) const {
+        return std::apply([&m](const auto&... p) { return (p(m) && ...); }, preds);
+    }
+
+    std::string describe() const { return describeAll(preds, " AND "); }
+};
+
+template <typename... Ps>
+struct AnyOf {
+    std::tuple<Ps...> preds;
+
+    bool operator()(const Material& m) const {
+        return std::apply([&m](const auto&... p) { return (p(m) || ...); }, preds);
+    }
+
+    std::string describe() const { return describeAll(preds, " OR "); }
+};
+
+template <typename... Ps>
+AllOf<Ps...> allOf(Ps... ps) { return {{std::move(ps)...}}; }
+
+template <typename... Ps>
+AnyOf<Ps...> anyOf(Ps... ps) { return {{std::move(ps)...}}; }
+
+} // namespace query
+
+// ===================== ALERTE STOC =====================
+struct StockEvent {
+    enum class Type { Enter, Leave };
+
+    Type type;
+    std::string watch;
+    int32_t id;
+    int32_t qty;
+    int32_t threshold;
+};
+
+// Interogare permanenta "cantitate <= prag" (sau "== prag"), evaluata
+// incremental. Materialele sunt tinute intr-un set ordonat dupa distanta
+// pana la prag (cantitate - prag); alertele active sunt prefixul cu
+// distanta <= 0 (sau blocul cu distanta 0), iar o modificare de
+// cantitate costa O(log N).
+class StockWatch {
+public:
+    enum class Kind {
+        Threshold,    // cantitate <= prag fix, comun tuturor materialelor
+        Equal,        // cantitate == prag fix (ex: epuizat, prag 0)
+        ReorderLevel  // cantitate <= pragul individual setat cu setReorderLevel
+    };
+    using Callback = std::function<void(const StockEvent&)>;
+
+private:
+    struct Entry {
+        int32_t qty;
+        int32_t threshold;
+        int64_t distance() const { return int64_t(qty) - threshold; }
+    };
+
+    std::string name;
+    Kind kind;
+    int32_t threshold;
+    Callback callback;
+    std::string eventFile;
+
+    std::set<std::pair<int64_t, int32_t>> index; // (distanta, id)
+    std::unordered_map<int32_t, Entry> entries;
+
+    bool matches(int64_t distance) const {
+        return kind == Kind::Equal ? distance == 0 : distance <= 0;
+    }
+
+    bool thresholdFor(int32_t id, const std::map<int32_t, int32_t>& levels,
+                      int32_t& t) const {
+        if (kind != Kind::ReorderLevel) {
+            t = threshold;
+            return true;
+        }
+        auto it = levels.find(id);
+        if (it == levels.end()) return false;
+        t = it->second;
+        return true;
+    }
+
+    void insert(int32_t id, int32_t qty, int32_t t) {
+        Entry e{qty, t};
+        index.emplace(e.distance(), id);
+        entries[id] = e;
+    }
+
+    void emit(StockEvent::Type type, int32_t id, const Entry& e) const {
+        StockEvent ev{type, name, id, e.qty, e.threshold};
+        if (callback) callback(ev);
+        if (eventFile.empty()) return;
+
+        std::ofstream f(eventFile, std::ios::app);
+        if (!f) {
+            std::cerr << "NU POT SCRIE " << eventFile << "\n";
+            return;
+        }
+        f << now() << " | "
+          << (type == StockEvent::Type::Enter ? "ENTER" : "LEAVE")
+          << " watch=" << name
+          << " ID=" << id
+          << " QTY=" << e.qty
+          << " PRAG=" << e.threshold << "\n";
+    }
+
+public:
+    StockWatch(std::string n, Kind k, int32_t t = 0,
+               Callback cb = nullptr, std::string file = "")
+        : name(std::move(n)), kind(k), threshold(t),
+          callback(std::move(cb)), eventFile(std::move(file)) {}
+
+    const std::string& getName() const { return name; }
+
+    // Un material a fost adaugat sau i s-a schimbat cantitatea / pragul
+    void update(const Material& m, const std::map<int32_t, int32_t>& levels) {
+        int32_t id = m.getId();
+        bool was = false;
+        Entry old{};
+
+        auto it = entries.find(id);
+        if (it != entries.end()) {
+            old = it->second;
+            was = matches(old.distance());
+            index.erase({old.distance(), id});
+            entries.erase(it);
+        }
+
+        int32_t t;
+        if (!thresholdFor(id, levels, t)) {
+            if (was) emit(StockEvent::Type::Leave, id, old);
+            return;
+        }
+
+        insert(id, m.getQty(), t);
+        const Entry& cur = entries[id];
+        bool is = matches(cur.distance());
+        if (is != was)
+            emit(is ? StockEvent::Type::Enter : StockEvent::Type::Leave, id, cur);
+    }
+
+    // Materialul a fost sters din depozit
+    void erase(int32_t id) {
+        auto it = entries.find(id);
+        if (it == entries.end()) return;
+
+        Entry old = it->second;
+        index.erase({old.distance(), id});
+        entries.erase(it);
+        if (matches(old.distance()))
+            emit(StockEvent::Type::Leave, id, old);
+    }
+
+    // Inventarul a fost inlocuit in bloc (load, undo, redo, import cu
+    // inlocuire): reconstruieste indexul, O(N log N), si emite doar
+    // tranzitiile reale fata de starea anterioara, in ordinea indexului.
+    void rebuild(const std::vector<Material>& items,
+                 const std::map<int32_t, int32_t>& levels,
+                 bool emitEvents = true) {
+        auto oldIndex = std::move(index);
+        auto before = std::move(entries);
+        index.clear();
+        entries.clear();
+
+        for (const auto& m : items) {
+            int32_t t;
+            if (thresholdFor(m.getId(), levels, t))
+                insert(m.getId(), m.getQty(), t);
+        }
+
+        if (!emitEvents) return;
+
+        for (const auto& [dist, id] : oldIndex) {
+            if (!matches(dist)) continue;
+            const Entry& e = before[id];
+            auto it = entries.find(id);
+            if (it == entries.end())
+                emit(StockEvent::Type::Leave, id, e);
+            else if (!matches(it->second.distance()))
+                emit(StockEvent::Type::Leave, id, it->second);
+        }
+        for (const auto& [dist, id] : index) {
+            if (!matches(dist)) continue;
+            const Entry& e = entries[id];
+            auto it = before.find(id);
+            if (it == before.end() || !matches(it->second.distance()))
+                emit(StockEvent::Type::Enter, id, e);
+        }
+    }
+
+    // ID-urile in alerta, cele mai critice primele
+    std::vector<int32_t> active() const {
+        std::vector<int32_t> r;
+        auto it = kind == Kind::Equal
+            ? index.lower_bound({0, std::numeric_limits<int32_t>::min()})
+            : index.begin();
+        for (; it != index.end() && matches(it->first); ++it)
+            r.push_back(it->second);
+        return r;
+    }
 };
 
 // ===================== DEPOZIT =====================
 class Depozit {
     std::vector<Material> items;
     std::string filename;
-    std::vector<std::vector<Material>> undoStack;
-    std::vector<std::vector<Material>> redoStack;
+    std::vector<StockWatch> watches;
+    std::map<int32_t, int32_t> reorderLevels;
+
+    // undo/redo restaureaza si nivelurile, altfel un material readus
+    // de undo ar iesi din alerta "reaprovizionare"
+    struct Snapshot {
+        std::vector<Material> items;
+        std::map<int32_t, int32_t> reorderLevels;
+    };
+    std::vector<Snapshot> undoStack;
+    std::vector<Snapshot> redoStack;
+
+    void notifyWatches(const Material& m) {
+        for (auto& w : watches) w.update(m, reorderLevels);
+    }
+
+    void rebuildWatches() {
+        for (auto& w : watches) w.rebuild(items, reorderLevels);
+    }
+
+    std::unordered_set<int32_t> idSet() const {
+        std::unordered_set<int32_t> ids;
+        ids.reserve(items.size());
+        for (const auto& m : items) ids.insert(m.getId());
+        return ids;
+    }
+
+    // scoate nivelurile materialelor care nu mai exista, ca un ID refolosit
+    // sa nu mosteneasca pragul vechi
+    void pruneLevels() {
+        auto ids = idSet();
+        for (auto it = reorderLevels.begin(); it != reorderLevels.end(); )
+            it = ids.count(it->first) ? std::next(it) : reorderLevels.erase(it);
+    }
+
+    // nivelurile de reaprovizionare stau langa fisierul binar, ca text
+    // "ID NIVEL" pe linie, ca formatul depozit.dat sa ramana neschimbat
+    std::string levelsFile() const { return filename + ".niveluri"; }
+
+    void loadLevels() {
+        reorderLevels.clear();
+        std::ifstream f(levelsFile());
+        auto ids = idSet(); // O(N + L), nu exists() pe fiecare linie
+        int32_t id;
+        int32_t level;
+        while (f >> id >> level)
+            if (ids.count(id) && level >= 0) reorderLevels[id] = level;
+    }
+
+    void saveLevels() const {
+        std::ofstream f(levelsFile());
+        if (!f) throw FileException("Nu pot salva nivelurile de reaprovizionare");
+        for (const auto& [id, level] : reorderLevels)
+            f << id << " " << level << "\n";
+    }
+
+    template <typename Pred>
+    std::vector<Material> selectWhere(const Pred& p) const {
+        std::vector<Material> r;
+        std::copy_if(items.begin(), items.end(), std::back_inserter(r), p);
+        return r;
+    }
+
+    template <typename... Keys>
+    std::vector<Material> sorted() const {
+        auto r = items;
+        std::sort(r.begin(), r.end(), query::Compare<Keys...>{});
+        return r;
+    }
 
 public:
     explicit Depozit(std::string f) : filename(std::move(f)) 
@@ -150,6 +548,7 @@ public:
 
         saveState(); // FOARTE IMPORTANT
         items.push_back(m);
+        notifyWatches(m);
 
         logAction("ADD ID=" + std::to_string(m.getId()) +
           " NAME=" + m.getName() +
@@ -161,14 +560,14 @@ public:
 
     void remove(int id)    
     {
-        auto it = std::remove_if(items.begin(), items.end(),
-            [id](const Material& m){ return m.getId() == id; });
-
-        if (it == items.end())
+        if (!exists(id))
             throw DataException("ID inexistent");
 
-        saveState(); 
-        items.erase(it, items.end());
+        saveState(); // inainte de remove_if, care muta elementele
+        items.erase(std::remove_if(items.begin(), items.end(),
+            [id](const Material& m){ return m.getId() == id; }), items.end());
+        reorderLevels.erase(id);
+        for (auto& w : watches) w.erase(id);
 
         logAction("DELETE material ID=" + std::to_string(id));
     }
@@ -180,9 +579,11 @@ public:
         if (undoStack.empty())
             return false;
 
-        redoStack.push_back(items);
-        items = undoStack.back();
+        redoStack.push_back({items, reorderLevels});
+        items = std::move(undoStack.back().items);
+        reorderLevels = std::move(undoStack.back().reorderLevels);
         undoStack.pop_back();
+        rebuildWatches();
 
         logAction("UNDO");
         return true;
@@ -193,9 +594,11 @@ public:
         if (redoStack.empty())
             return false;
 
-        undoStack.push_back(items);
-        items = redoStack.back();
+        undoStack.push_back({items, reorderLevels});
+        items = std::move(redoStack.back().items);
+        reorderLevels = std::move(redoStack.back().reorderLevels);
         redoStack.pop_back();
+        rebuildWatches();
 
         logAction("REDO");
         return true;
@@ -208,6 +611,7 @@ public:
             if (m.getId() == id) {
                 saveState();
                 m.setQty(q);
+                notifyWatches(m);
                 logAction("UPDATE QTY ID=" + std::to_string(id) +
                           " NEW_QTY=" + std::to_string(q));
                 return;
@@ -220,27 +624,48 @@ public:
             [id](const Material& m){ return m.getId() == id; });
     }
 
+    // ================= QUERY GENERIC =================
+    // ex: d.filter(query::where<Material::Qty, query::LessEq>(4))
+    //     d.filter(query::anyOf(where<...>(...), [](const Material& m){ ... }))
+    template <typename Pred>
+    std::vector<Material> filter(const Pred& p) const {
+        auto r = selectWhere(p);
+        logAction("FILTER " + query::describe(p));
+        return r;
+    }
+
+    // ex: d.sortBy<query::By<Material::Qty>, query::By<Material::Price, query::Order::Desc>>()
+    template <typename... Keys>
+    std::vector<Material> sortBy() const {
+        auto r = sorted<Keys...>();
+        logAction("SORT " + query::Compare<Keys...>::describe());
+        return r;
+    }
+
+    template <typename F>
+    query::SumType<F> sum() const {
+        static_assert(std::is_arithmetic_v<query::FieldType<F>>,
+                      "sum se aplica doar campurilor numerice");
+        query::SumType<F> s{};
+        for (const auto& m : items) s += F::get(m);
+        return s;
+    }
+
     // ================= FILTRE =================
     std::vector<Material> lowStock(int t = 5) const {
-        std::vector<Material> r;
-        for (const auto& m : items)
-            if (m.getQty() <= t) r.push_back(m);
+        auto r = selectWhere(query::where<Material::Qty, query::LessEq>(t));
         logAction("FILTER lowStock <= " + std::to_string(t));    
         return r;
     }
 
     std::vector<Material> outOfStock() const {
-        std::vector<Material> r;
-        for (const auto& m : items)
-            if (m.getQty() == 0) r.push_back(m);
+        auto r = selectWhere(query::where<Material::Qty, query::Eq>(0));
         logAction("FILTER outOfStock");
         return r;
     }
 
     std::vector<Material> expensive(double p = 10000) const {
-        std::vector<Material> r;
-        for (const auto& m : items)
-            if (m.getPrice() > p) r.push_back(m);
+        auto r = selectWhere(query::where<Material::Price, query::Greater>(p));
         logAction("FILTER expensive > " + std::to_string(p));
         return r;
     }
@@ -261,32 +686,22 @@ public:
     }
 
     // ================= SORTARI =================
+    // directia se alege o singura data, nu la fiecare comparatie
     std::vector<Material> sortByPrice(bool asc = true) const {
-        auto r = items;
-        std::sort(r.begin(), r.end(),
-            [asc](const Material& a, const Material& b) {
-                return asc ? a.getPrice() < b.getPrice()
-                           : a.getPrice() > b.getPrice();
-            });
-        logAction(std::string("SORT price ") + (asc ? "ASC" : "DESC"));
-        return r;
+        using namespace query;
+        return asc ? sortBy<By<Material::Price, Order::Asc>>()
+                   : sortBy<By<Material::Price, Order::Desc>>();
     }
 
     std::vector<Material> sortByQuantity(bool asc = true) const {
-        auto r = items;
-        std::sort(r.begin(), r.end(),
-            [asc](const Material& a, const Material& b) {
-                return asc ? a.getQty() < b.getQty()
-                           : a.getQty() > b.getQty();
-            });
-        logAction(std::string("SORT quantity ") + (asc ? "ASC" : "DESC"));
-        return r;
+        using namespace query;
+        return asc ? sortBy<By<Material::Qty, Order::Asc>>()
+                   : sortBy<By<Material::Qty, Order::Desc>>();
     }
 
     // ================= STATISTICI =================
     double totalValue() const {
-        double s = 0;
-        for (const auto& m : items) s += m.value();
+        double s = sum<Material::Value>();
         logAction("STATS totalValue=" + std::to_string(s));
         return s;
     }
@@ -297,11 +712,21 @@ public:
         std::ifstream f(filename, std::ios::binary);
         if (!f) 
         {
+            reorderLevels.clear();
+            rebuildWatches();
             logAction("LOAD failed (file missing)");
             return;
         }
-        while (f.peek() != EOF)
-            items.push_back(Material::deserialize(f));
+        try {
+            while (f.peek() != EOF)
+                items.push_back(Material::deserialize(f));
+        } catch (...) {
+            loadLevels();
+            rebuildWatches(); // alertele raman aliniate cu ce s-a citit
+            throw;
+        }
+        loadLevels();
+        rebuildWatches();
 
         undoStack.clear();
         redoStack.clear();
@@ -315,6 +740,7 @@ public:
         if (!f) throw FileException("Nu pot salva fisierul");
         for (const auto& m : items)
             m.serialize(f);
+        saveLevels();
 
         logAction("SAVE to file=" + filename);
     }
@@ -344,39 +770,50 @@ void importCSV(const std::string& inFile, bool replace = false) {
     if (replace)
         items.clear();
 
-    std::string line;
-    std::getline(f, line); // sari peste header
+    try {
+        std::string line;
+        std::getline(f, line); // sari peste header
 
-    while (std::getline(f, line)) {
-        if (line.empty()) continue;
+        while (std::getline(f, line)) {
+            if (line.empty()) continue;
 
-        std::stringstream ss(line);
-        std::string field;
+            std::stringstream ss(line);
+            std::string field;
 
-        int id;
-        int cant;
-        double pret;
-        std::string nume;
+            int id;
+            int cant;
+            double pret;
+            std::string nume;
 
-        // ID
-        std::getline(ss, field, ',');
-        id = std::stoi(field);
+            // ID
+            std::getline(ss, field, ',');
+            id = std::stoi(field);
 
-        // Denumire
-        std::getline(ss, nume, ',');
+            // Denumire
+            std::getline(ss, nume, ',');
 
-        // Cantitate
-        std::getline(ss, field, ',');
-        cant = std::stoi(field);
+            // Cantitate
+            std::getline(ss, field, ',');
+            cant = std::stoi(field);
 
-        // Pret
-        std::getline(ss, field, ',');
-        pret = std::stod(field);
+            // Pret
+            std::getline(ss, field, ',');
+            pret = std::stod(field);
 
-        if (exists(id))
-            throw DataException("ID duplicat in CSV: " + std::to_string(id));
+            if (exists(id))
+                throw DataException("ID duplicat in CSV: " + std::to_string(id));
 
-        items.emplace_back(id, nume, cant, pret);
+            items.emplace_back(id, nume, cant, pret);
+            notifyWatches(items.back());
+        }
+    } catch (...) {
+        if (replace) pruneLevels();
+        rebuildWatches(); // importul partial ramane in items
+        throw;
+    }
+    if (replace) {
+        pruneLevels();
+        rebuildWatches(); // scoate materialele care nu mai exista
     }
     logAction("IMPORT CSV file=" + inFile +
                   (replace ? " REPLACE" : " APPEND"));
@@ -416,13 +853,60 @@ void importCSV(const std::string& inFile, bool replace = false) {
 
     void saveState() 
     {
-        undoStack.push_back(items);
+        undoStack.push_back({items, reorderLevels});
         if (undoStack.size() > 20)
             undoStack.erase(undoStack.begin());
         redoStack.clear();
     }
 
 
+    // ================= ALERTE STOC =================
+    void addWatch(StockWatch w) {
+        for (const auto& x : watches)
+            if (x.getName() == w.getName())
+                throw DataException("Alerta deja existenta: " + w.getName());
+
+        w.rebuild(items, reorderLevels, false); // porneste de la starea curenta
+        logAction("WATCH add name=" + w.getName());
+        watches.push_back(std::move(w));
+    }
+
+    void setReorderLevel(int id, int level) {
+        if (level < 0) throw DataException("Nivel negativ");
+
+        auto it = std::find_if(items.begin(), items.end(),
+            [id](const Material& m){ return m.getId() == id; });
+        if (it == items.end())
+            throw DataException("ID inexistent");
+
+        saveState();
+        reorderLevels[id] = level;
+        notifyWatches(*it);
+        logAction("REORDER LEVEL ID=" + std::to_string(id) +
+                  " LEVEL=" + std::to_string(level));
+    }
+
+    std::vector<Material> alerts(const std::string& watch) const {
+        auto w = std::find_if(watches.begin(), watches.end(),
+            [&watch](const StockWatch& x){ return x.getName() == watch; });
+        if (w == watches.end())
+            throw DataException("Alerta inexistenta: " + watch);
+
+        // o singura trecere prin items: O(N + K), nu O(K * N)
+        std::unordered_map<int32_t, size_t> pos;
+        pos.reserve(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+            pos.emplace(items[i].getId(), i);
+
+        std::vector<Material> r;
+        for (int32_t id : w->active()) {
+            auto it = pos.find(id);
+            if (it != pos.end()) r.push_back(items[it->second]);
+        }
+        logAction("ALERTS watch=" + watch);
+        return r;
+    }
+
     // ================= ACCESS =================
     const std::vector<Material>& all() const { return items; }
 };
@@ -517,6 +1001,9 @@ void showMenu() {
               << "17. Undo ultima operatie\n"
               << "18. Redo operatie\n"
               << "---------------------------------------------\n"
+              << "19. Afisare materiale sub nivelul de reaprovizionare\n"
+              << "20. Seteaza nivel de reaprovizionare\n"
+              << "---------------------------------------------\n"
               << "Alege optiunea: ";
 }
 
@@ -536,6 +1023,17 @@ int main() {
         d.demo();
     }
 
+    // inregistrate dupa incarcare: la pornire nu se reemit alertele deja active
+    auto printEvent = [](const StockEvent& e) {
+        std::cout << (e.type == StockEvent::Type::Enter ? "[ALERTA] " : "[OK] ")
+                  << e.watch << ": ID=" << e.id
+                  << " cantitate=" << e.qty
+                  << " (prag " << e.threshold << ")\n";
+    };
+    d.addWatch({"stoc<=4", StockWatch::Kind::Threshold, 4, printEvent, "alerte.txt"});
+    d.addWatch({"epuizat", StockWatch::Kind::Equal, 0, printEvent, "alerte.txt"});
+    d.addWatch({"reaprovizionare", StockWatch::Kind::ReorderLevel, 0, printEvent, "alerte.txt"});
+
     bool ruleaza = true;
     while (ruleaza) { 
     showMenu();
@@ -551,11 +1049,11 @@ int main() {
             break;
 
         case 2: // Cantitate <= 4
-            printPaged(d.lowStock(4));
+            printPaged(d.alerts("stoc<=4"));
             break;
 
         case 3: // Epuizate
-            printPaged(d.outOfStock());
+            printPaged(d.alerts("epuizat"));
             break;
 
         case 4: // Scumpe
@@ -655,6 +1153,18 @@ int main() {
                 std::cout << "Nu exista redo.\n";
             break;
 
+        case 19: // Sub nivelul de reaprovizionare
+            printPaged(d.alerts("reaprovizionare"));
+            break;
+
+        case 20: { // Nivel de reaprovizionare
+            int id = readInt("ID material: ");
+            int nivel = readInt("Nivel reaprovizionare: ");
+            d.setReorderLevel(id, nivel);
+            std::cout << "Nivel de reaprovizionare setat.\n";
+            break;
+        }
+
 
         case 6: // Salvare si iesire
             d.save();